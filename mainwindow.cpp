@@ -1,6 +1,8 @@
 #include "mainwindow.h"
 #include <QMessageBox>
 #include <QDebug>
+#include <QStatusBar>
+#include <algorithm>
 
 /* Implementation for Genre Selection */
 GenreSelectionDialog::GenreSelectionDialog(const QStringList& availableGenres, QWidget* parent) : QDialog(parent)
@@ -62,6 +64,13 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), availableGenres({
     searchButton = new QPushButton("Search");
     resultsList = new QListWidget();
 
+    searchDebounceTimer = new QTimer(this);
+    searchDebounceTimer->setSingleShot(true);
+    searchDebounceTimer->setInterval(250);
+
+    resultsDrainTimer = new QTimer(this);
+    resultsDrainTimer->setInterval(16);
+
     // Layout for data structure selection
     QHBoxLayout* dataStructureLayout = new QHBoxLayout();
     dataStructureLayout->addWidget(dataStructureLabel);
@@ -103,11 +112,20 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), availableGenres({
     connect(searchButton, &QPushButton::clicked, this, &MainWindow::searchButtonClicked);
     connect(genreButton, &QPushButton::clicked, this, &MainWindow::showGenreSelectionDialog);
     connect(refreshButton, &QPushButton::clicked, this, &MainWindow::refreshDataStructure);
+
+    // Search as the user types
+    connect(minYearEdit, &QLineEdit::textChanged, this, &MainWindow::scheduleSearch);
+    connect(maxYearEdit, &QLineEdit::textChanged, this, &MainWindow::scheduleSearch);
+    connect(minRuntimeEdit, &QLineEdit::textChanged, this, &MainWindow::scheduleSearch);
+    connect(maxRuntimeEdit, &QLineEdit::textChanged, this, &MainWindow::scheduleSearch);
+    connect(searchDebounceTimer, &QTimer::timeout, this, &MainWindow::runLiveSearch);
+    connect(resultsDrainTimer, &QTimer::timeout, this, &MainWindow::drainResults);
 }
 
 /* Main Window Destructor */
 MainWindow::~MainWindow()
 {
+    cancelSearch(); // The worker must finish before its data structure goes away
     delete movieSearch;
 }
 
@@ -128,13 +146,13 @@ void MainWindow::showGenreSelectionDialog()
         {
             genreButton->setText("Select Genres...");
         }
+        scheduleSearch();
     }
 }
 
-/* Searching for Results */
-void MainWindow::searchButtonClicked()
+/* Read and Verify the Search Inputs */
+bool MainWindow::readCriteria(Criteria& criteria, bool showErrors)
 {
-    Criteria criteria;
     // Verify inputs to search
     bool checkMinYear, checkMaxYear, checkMinRuntime, checkMaxRuntime;
 
@@ -145,23 +163,27 @@ void MainWindow::searchButtonClicked()
 
     if (!minYearEdit->text().isEmpty() && !checkMinYear)
     {
-        QMessageBox::warning(this, "Input Error", "Invalid minimum year.");
-        return;
+        if (showErrors)
+            QMessageBox::warning(this, "Input Error", "Invalid minimum year.");
+        return false;
     }
     if (!maxYearEdit->text().isEmpty() && !checkMaxYear)
     {
-        QMessageBox::warning(this, "Input Error", "Invalid maximum year.");
-        return;
+        if (showErrors)
+            QMessageBox::warning(this, "Input Error", "Invalid maximum year.");
+        return false;
     }
     if (!minRuntimeEdit->text().isEmpty() && !checkMinRuntime)
     {
-        QMessageBox::warning(this, "Input Error", "Invalid minimum runtime.");
-        return;
+        if (showErrors)
+            QMessageBox::warning(this, "Input Error", "Invalid minimum runtime.");
+        return false;
     }
     if (!maxRuntimeEdit->text().isEmpty() && !checkMaxRuntime)
     {
-        QMessageBox::warning(this, "Input Error", "Invalid maximum runtime.");
-        return;
+        if (showErrors)
+            QMessageBox::warning(this, "Input Error", "Invalid maximum runtime.");
+        return false;
     }
 
     // Assign criteria
@@ -170,16 +192,128 @@ void MainWindow::searchButtonClicked()
     criteria.min_runtime = checkMinRuntime ? minRuntime : INT_MIN;
     criteria.max_runtime = checkMaxRuntime ? maxRuntime : INT_MAX;
     criteria.genres = selectedMovieGenres;
+    return true;
+}
+
+/* Searching for Results */
+void MainWindow::searchButtonClicked()
+{
+    searchDebounceTimer->stop();
+    Criteria criteria;
+    if (readCriteria(criteria, true))
+    {
+        startSearch(criteria);
+    }
+}
+
+/* Restart the Debounce Timer After an Input Change */
+void MainWindow::scheduleSearch()
+{
+    // The running search no longer matches the input, so stop it now rather
+    // than when the timer fires; rows already shown stay up until then
+    cancelSearch();
+    searchDebounceTimer->start();
+}
+
+/* Live Search Once Input Has Settled */
+void MainWindow::runLiveSearch()
+{
+    // Partially typed input (such as a lone "-") gets no warning, but the
+    // old results no longer match the input so they are cleared
+    Criteria criteria;
+    if (!readCriteria(criteria, false))
+    {
+        cancelSearch();
+        resultsList->clear();
+        statusBar()->showMessage("Incomplete search input.");
+        return;
+    }
+    startSearch(criteria);
+}
 
-    // Search for results
-    std::vector<const Movie*> results = movieSearch->search(criteria);
+/* Run a Search on a Worker Thread, Replacing Any Search in Progress */
+void MainWindow::startSearch(const Criteria& criteria)
+{
+    cancelSearch();
+    statusBar()->clearMessage();
+
+    // The previous results stay up until the new search has something to
+    // show, so the list does not flash blank on every keystroke
+    resultsStale = true;
+    searchFinished = false;
+
+    // The worker queues each match, and the GUI thread drains them on a timer
+    MainWindow* window = this;
+    searchControl = std::make_shared<SearchControl>([window](const Movie* movie)
+    {
+        std::lock_guard<std::mutex> lock(window->pendingMutex);
+        window->pendingResults.push_back(movie);
+    });
 
-    // Display results
-    resultsList->clear();
-    for (const Movie* movie : results)
+    MovieSearch* search = movieSearch;
+    std::shared_ptr<SearchControl> control = searchControl;
+    searchThread = std::thread([window, search, criteria, control]()
+    {
+        search->search(criteria, *control);
+        window->searchFinished = true;
+    });
+    resultsDrainTimer->start();
+}
+
+/* Abort the Search in Progress and Wait for its Worker */
+void MainWindow::cancelSearch()
+{
+    if (searchControl != nullptr)
     {
-        QString movieInfo = QString("Title: %1\nYear: %2\nRuntime: %3\nGenre: %4").arg(QString::fromStdString(movie->title)).arg(movie->year).arg(movie->runtime).arg(QString::fromStdString(movie->genre));
-        resultsList->addItem(movieInfo);
+        searchControl->cancel();
+    }
+    if (searchThread.joinable())
+    {
+        searchThread.join();
+    }
+    searchControl.reset();
+    resultsDrainTimer->stop();
+
+    std::lock_guard<std::mutex> lock(pendingMutex);
+    pendingResults.clear();
+}
+
+/* Display the Next Chunk of Pending Results */
+void MainWindow::drainResults()
+{
+    // Capped so the event loop can paint and handle input between chunks
+    const std::size_t maxRowsPerTick = 256;
+
+    // Checked before taking the chunk, so matches queued just before the
+    // worker finished are not left behind
+    bool finished = searchFinished;
+    std::vector<const Movie*> chunk;
+    bool morePending;
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex);
+        std::size_t count = std::min(pendingResults.size(), maxRowsPerTick);
+        chunk.assign(pendingResults.begin(), pendingResults.begin() + count);
+        pendingResults.erase(pendingResults.begin(), pendingResults.begin() + count);
+        morePending = !pendingResults.empty();
+    }
+
+    // Replace the previous results once the new search has an answer
+    if (resultsStale && (!chunk.empty() || finished))
+    {
+        resultsList->clear();
+        resultsStale = false;
+    }
+
+    QStringList rows;
+    for (const Movie* movie : chunk)
+    {
+        rows.append(QString("Title: %1\nYear: %2\nRuntime: %3\nGenre: %4").arg(QString::fromStdString(movie->title)).arg(movie->year).arg(movie->runtime).arg(QString::fromStdString(movie->genre)));
+    }
+    resultsList->addItems(rows);
+
+    if (finished && !morePending)
+    {
+        resultsDrainTimer->stop();
     }
 }
 
@@ -196,6 +330,7 @@ void MainWindow::refreshDataStructure()
     }
 
     // Otherwise, clear the old data structure
+    cancelSearch(); // The worker must finish before its data structure goes away
     if (movieSearch != nullptr)
     {
         delete movieSearch; // Delete the old data structure
@@ -222,6 +357,13 @@ void MainWindow::refreshDataStructure()
         movieSearch->load("movies.tsv");
         currentDataStructure = selected;
         resultsList->clear(); // Clear previous search results
+
+        // Show results for the current input from the new data structure
+        Criteria criteria;
+        if (readCriteria(criteria, false))
+        {
+            startSearch(criteria);
+        }
         QMessageBox::information(this, "Refresh", "Movie data reorganized using " + currentDataStructure + ".");
     }
     else
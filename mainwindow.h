@@ -14,6 +14,12 @@
 #include <QDialog>     // For the popup dialog
 #include <QDialogButtonBox>
 #include <QStringList>
+#include <QTimer>
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include "movie-search.h"
 
 /* Genre Selection Functionality */
@@ -42,8 +48,15 @@ private slots:
     void searchButtonClicked();
     void showGenreSelectionDialog();
     void refreshDataStructure();
+    void scheduleSearch();
+    void runLiveSearch();
+    void drainResults();
 
 private:
+    bool readCriteria(Criteria& criteria, bool showErrors);
+    void startSearch(const Criteria& criteria);
+    void cancelSearch();
+
     QLineEdit* minYearEdit;
     QLineEdit* maxYearEdit;
     QLineEdit* minRuntimeEdit;
@@ -57,6 +70,14 @@ private:
     QComboBox* dataStructureCombo; // New combo box for data structure selection
     QPushButton* refreshButton;    // New button to refresh data structure
     QString currentDataStructure; // To store the currently selected data structure
+    QTimer* searchDebounceTimer; // Delays live search until input settles
+    std::thread searchThread; // Worker running the current search
+    std::shared_ptr<SearchControl> searchControl; // Cancels the current search
+    QTimer* resultsDrainTimer; // Moves pending matches into the results list once per frame
+    std::mutex pendingMutex; // Guards pendingResults, which the worker appends to
+    std::deque<const Movie*> pendingResults; // Matches not yet shown in the results list
+    std::atomic<bool> searchFinished{false}; // Set by the worker once its scan is done
+    bool resultsStale = false; // Results list still shows the previous search
 };
 
 #endif // MAINWINDOW_H
@@ -27,6 +27,15 @@ static QStringList tabsplit(const QString& line)
     return fields;
 }
 
+/* Collect Every Match of a Search */
+std::vector<const Movie*> MovieSearch::search(const Criteria& criteria)
+{
+    std::vector<const Movie*> result;
+    SearchControl control([&result](const Movie* movie) { result.push_back(movie); });
+    search(criteria, control);
+    return result;
+}
+
 /* Vector - Load Movies */
 void LinearMovieSearch::load(const std::string& filename)
 {
@@ -70,13 +79,17 @@ void LinearMovieSearch::load(const std::string& filename)
 }
 
 /* Vector - Linear Search for Movies */
-std::vector<const Movie*> LinearMovieSearch::search(const Criteria& criteria)
+void LinearMovieSearch::search(const Criteria& criteria, SearchControl& control)
 {
-    std::vector<const Movie*> result;
     const QStringList& selectedGenres = criteria.genres;
 
     for (const Movie& movie : movies)
     {
+        // Abandon the scan as soon as a newer query supersedes this one
+        if (control.cancelled())
+        {
+            return;
+        }
         bool genreMatch = selectedGenres.isEmpty();
         // If genres are selected, split them as needed and verify each is met
         if (!selectedGenres.isEmpty())
@@ -111,10 +124,9 @@ std::vector<const Movie*> LinearMovieSearch::search(const Criteria& criteria)
         // Check if movie matches year and runtime
         if (movie.year >= criteria.min_year && movie.year <= criteria.max_year && movie.runtime >= criteria.min_runtime && movie.runtime <= criteria.max_runtime && genreMatch)
         {
-            result.push_back(&movie);
+            control.add(&movie);
         }
     }
-    return result;
 }
 
 /* BTree - Load Movies */
@@ -154,14 +166,18 @@ void BTreeMovieSearch::load(const std::string& filename)
 }
 
 /* BTree - Search for Movies */
-std::vector<const Movie*> BTreeMovieSearch::search(const Criteria& criteria)
+void BTreeMovieSearch::search(const Criteria& criteria, SearchControl& control)
 {
-    std::vector<const Movie*> result;
     const QStringList& selectedGenres = criteria.genres;
 
     for (const auto& pair : btreeMovies)
     {
         const Movie& movie = pair.second;
+        // Abandon the scan as soon as a newer query supersedes this one
+        if (control.cancelled())
+        {
+            return;
+        }
         bool genreMatch = selectedGenres.isEmpty();
         // If genres are selected, split them as needed and verify each is met
         if (!selectedGenres.isEmpty())
@@ -196,10 +212,9 @@ std::vector<const Movie*> BTreeMovieSearch::search(const Criteria& criteria)
         // Check if movie matches year and runtime
         if (movie.year >= criteria.min_year && movie.year <= criteria.max_year && movie.runtime >= criteria.min_runtime && movie.runtime <= criteria.max_runtime && genreMatch)
         {
-            result.push_back(&movie);
+            control.add(&movie);
         }
     }
-    return result;
 }
 
 /* HashMap - Load Movies */
@@ -239,14 +254,18 @@ void HashMapMovieSearch::load(const std::string& filename)
 }
 
 /* HashMap - Search for Movies */
-std::vector<const Movie*> HashMapMovieSearch::search(const Criteria& criteria)
+void HashMapMovieSearch::search(const Criteria& criteria, SearchControl& control)
 {
-    std::vector<const Movie*> result;
     const QStringList& selectedGenres = criteria.genres;
 
     for (const auto& pair : hashmapMovies)
     {
         const Movie& movie = pair.second;
+        // Abandon the scan as soon as a newer query supersedes this one
+        if (control.cancelled())
+        {
+            return;
+        }
         bool genreMatch = selectedGenres.isEmpty();
         // If genres are selected, split them as needed and verify each is met
         if (!selectedGenres.isEmpty())
@@ -281,8 +300,7 @@ std::vector<const Movie*> HashMapMovieSearch::search(const Criteria& criteria)
         // Check if movie matches year and runtime
         if (movie.year >= criteria.min_year && movie.year <= criteria.max_year && movie.runtime >= criteria.min_runtime && movie.runtime <= criteria.max_runtime && genreMatch)
         {
-            result.push_back(&movie);
+            control.add(&movie);
         }
     }
-    return result;
 }
@@ -2,11 +2,14 @@
 #define MOVIE_SEARCH_H
 
 #include <limits.h>
+#include <atomic>
+#include <functional>
 #include <string>
 #include <vector>
 #include <QStringList>
 #include <map>
 #include <unordered_map>
+#include <utility>
 
 /* Movie object */
 struct Movie
@@ -32,13 +35,34 @@ struct Criteria
     QStringList genres;
 };
 
+/* Cancellation and incremental delivery for a running search */
+class SearchControl
+{
+public:
+    using MatchCallback = std::function<void(const Movie*)>;
+    SearchControl(MatchCallback callback) :
+        cancelFlag(false),
+        matchCallback(std::move(callback)) {}
+    void cancel() { cancelFlag.store(true, std::memory_order_relaxed); }
+    bool cancelled() const { return cancelFlag.load(std::memory_order_relaxed); }
+    void add(const Movie* movie) { matchCallback(movie); }
+
+private:
+    std::atomic<bool> cancelFlag;
+    MatchCallback matchCallback;
+};
+
 /* General Movie Search Functionality */
 class MovieSearch
 {
 public:
     virtual ~MovieSearch() {}
     virtual void load(const std::string& filename) = 0;
-    virtual std::vector<const Movie*> search(const Criteria& criteria) = 0;
+    /* Returns every match */
+    std::vector<const Movie*> search(const Criteria& criteria);
+    /* Hands each match to the control as soon as it is found, stopping
+       early (with only part of the matches handed off) once cancelled */
+    virtual void search(const Criteria& criteria, SearchControl& control) = 0;
 };
 
 /* Vector - Linear Movie Search Functionality */
@@ -48,7 +72,8 @@ private:
     std::vector<Movie> movies;
 public:
     virtual void load(const std::string& filename) override;
-    virtual std::vector<const Movie*> search(const Criteria& criteria) override;
+    using MovieSearch::search;
+    virtual void search(const Criteria& criteria, SearchControl& control) override;
 };
 
 /* BTree Movie Search Functionality */
@@ -58,7 +83,8 @@ private:
     std::map<std::pair<std::string, int>, Movie> btreeMovies;
 public:
     virtual void load(const std::string& filename) override;
-    virtual std::vector<const Movie*> search(const Criteria& criteria) override;
+    using MovieSearch::search;
+    virtual void search(const Criteria& criteria, SearchControl& control) override;
 };
 
 /* HashMap Movie Search Funcitonality */
@@ -68,7 +94,8 @@ private:
     std::unordered_map<std::string, Movie> hashmapMovies;
 public:
     virtual void load(const std::string& filename) override;
-    virtual std::vector<const Movie*> search(const Criteria& criteria) override;
+    using MovieSearch::search;
+    virtual void search(const Criteria& criteria, SearchControl& control) override;
 };
 
 #endif // MOVIE_SEARCH_H